@@ -0,0 +1,168 @@
+/**
+ * @file ShiftAnd.cpp
+ * @brief Timing harness for the ShiftAnd input paths
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <xregex/engine/Search.hpp>
+#include <xregex/engine/ShiftAnd.hpp>
+
+using xregex::common::ByteClass;
+using xregex::engine::Match;
+using xregex::engine::ShiftAnd;
+
+/**
+ * @brief Time a single run of a search and print its throughput.
+ *
+ * @tparam Search A callable returning the number of matches found.
+ * @param name The name of the input path.
+ * @param bytes The size of the input.
+ * @param search The search to time.
+ */
+template <class Search>
+static void measure(const char* name, const size_t bytes, Search&& search)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const size_t matches = search();
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::printf
+    (
+        "%-30s %8.3f s %10.1f MiB/s %10zu matches\n",
+        name,
+        elapsed.count(),
+        bytes / elapsed.count() / (1 << 20),
+        matches
+    );
+}
+
+/**
+ * @brief Count the matches in a range through the generic stepping core.
+ *
+ * @tparam InputIt The iterator type of the range.
+ * @param matcher The matcher to run.
+ * @param first The beginning of the input.
+ * @param last The end of the input.
+ * @return size_t The number of non-overlapping matches.
+ */
+template <class InputIt>
+static size_t count(const ShiftAnd& matcher, InputIt first, const InputIt last)
+{
+    ShiftAnd::State state = 0;
+    size_t matches = 0;
+
+    matcher.scan(state, first, last, 0, [&](const Match&)
+    {
+        ++matches;
+        return true;
+    });
+
+    return matches;
+}
+
+/**
+ * @brief Run every input path over the same input.
+ *
+ * @param title The description of the pattern and input.
+ * @param matcher The matcher to run.
+ * @param input The input to search.
+ */
+static void run(const char* title, const ShiftAnd& matcher, std::string& input)
+{
+    const std::string& constant = input;
+    const std::deque<char> deque(input.begin(), input.end());
+
+    std::printf("%s\n", title);
+
+    measure("const char*", input.size(), [&]
+    {
+        return count(matcher, constant.data(), constant.data() + constant.size());
+    });
+
+    measure("char*", input.size(), [&]
+    {
+        return count(matcher, input.data(), input.data() + input.size());
+    });
+
+    measure("std::string::iterator", input.size(), [&]
+    {
+        return count(matcher, input.begin(), input.end());
+    });
+
+    measure("std::string::const_iterator", input.size(), [&]
+    {
+        return count(matcher, constant.begin(), constant.end());
+    });
+
+    measure("std::deque<char>::iterator", input.size(), [&]
+    {
+        return count(matcher, deque.begin(), deque.end());
+    });
+
+    std::printf("\n");
+}
+
+/**
+ * @brief Compare the sequential and the parallel search on the same input.
+ *
+ * @param title The description of the pattern and input.
+ * @param matcher The matcher to run.
+ * @param input The input to search.
+ */
+static void run_parallel(const char* title, const ShiftAnd& matcher, const std::string& input)
+{
+    std::printf("%s\n", title);
+
+    measure("find_all", input.size(), [&]
+    {
+        return find_all(matcher, input).size();
+    });
+
+    measure("find_all_parallel, 8 threads", input.size(), [&]
+    {
+        return matcher.find_all_parallel(input, 8).size();
+    });
+
+    std::printf("\n");
+}
+
+int main(const int argc, const char** argv)
+{
+    const size_t mebibytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 64;
+    const size_t bytes = mebibytes << 20;
+
+    std::string sparse(bytes, 'a');
+
+    for( size_t index = 4096; index < bytes; index += 4096 )
+    {
+        sparse[index - 1] = 's';
+        sparse[index] = 'x';
+    }
+
+    std::string dense(bytes, ' ');
+
+    for( size_t index = 0; index < bytes; ++index )
+    {
+        dense[index] = "ab"[(index * 7 + index / 3) % 2];
+    }
+
+    run("pattern \"x\", one match every 4 KiB", ShiftAnd({ 'x' }), sparse);
+    run("pattern \"[Ss]x\", one match every 4 KiB", ShiftAnd({ ByteClass({ 'S', 's' }), 'x' }), sparse);
+    run("pattern \"aba\", dense input", ShiftAnd({ 'a', 'b', 'a' }), dense);
+
+    run_parallel("pattern \"aaa\", a single run of a", ShiftAnd({ 'a', 'a', 'a' }), std::string(bytes, 'a'));
+    run_parallel("pattern \"aba\", dense input", ShiftAnd({ 'a', 'b', 'a' }), dense);
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file ByteClass.hpp
+ * @brief A precomputed per-byte membership table for multimatch classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <bitset>
+#include <cstddef>
+#include <vector>
+
+#include <xregex/common/RangedTree.hpp>
+
+namespace xregex::common
+{
+
+/**
+ * @brief A multimatch class (e.g. `[a-z^b]`) flattened into a table with
+ *        one membership bit per byte value.
+ *
+ * The class is described with the same entries used to build a `RangedTree`,
+ * split into inclusion and exclusion clauses. Membership is resolved once at
+ * construction, so a lookup is a single bit test with no branching on the
+ * structure of the class.
+ *
+ * The clauses follow the inclusion-exclusion rules from the README: if only
+ * exclusions are given every byte is assumed to be included, and a byte which
+ * is excluded is never a member, even if it was also included.
+ *
+ */
+class ByteClass final
+{
+public:
+
+    /// The entry type shared with `RangedTree`
+    typedef RangedTree<char>::Entry Entry;
+
+    /// The number of distinct byte values
+    static constexpr size_t SIZE = 256;
+
+private:
+
+    /// The membership bit of each byte value
+    std::bitset<SIZE> _members;
+
+
+    /**
+     * @brief Set the membership of every byte covered by an entry.
+     *
+     * @param entry The single value or range to apply.
+     * @param value Whether the covered bytes are members.
+     */
+    void _apply(const Entry& entry, const bool value);
+
+public:
+
+    /**
+     * @brief Convenience constructor for a class matching a single literal.
+     *
+     * @param value The only byte in the class.
+     */
+    ByteClass(const char value);
+
+    /**
+     * @brief Construct a class from its inclusion and exclusion clauses.
+     *
+     * @throws std::invalid_argument If no clauses are supplied, or a range
+     *                               ends before it starts.
+     *
+     * @param inclusions The values and ranges included in the class.
+     * @param exclusions The values and ranges excluded from the class.
+     */
+    ByteClass
+    (
+        const std::vector<Entry>& inclusions,
+        const std::vector<Entry>& exclusions = {}
+    );
+
+
+    /**
+     * @brief Checks whether a byte is a member of this class.
+     *
+     * @param byte The byte to check.
+     * @return bool Whether the byte is in this class.
+     */
+    inline bool contains(const unsigned char byte) const noexcept { return _members[byte]; }
+
+    /**
+     * @brief Gets the number of bytes in this class.
+     *
+     * @return size_t The number of member bytes.
+     */
+    inline size_t count() const noexcept { return _members.count(); }
+
+
+    /**
+     * @brief Convenience operator for membership lookup.
+     *
+     * @param byte The byte to search for.
+     * @return bool If the byte is in the class.
+     */
+    inline bool operator[](const unsigned char byte) const noexcept { return contains(byte); }
+
+};
+
+}
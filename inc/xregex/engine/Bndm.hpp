@@ -0,0 +1,96 @@
+/**
+ * @file Bndm.hpp
+ * @brief A backward skipping matcher for fixed-length class sequences.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <xregex/common/ByteClass.hpp>
+#include <xregex/engine/Match.hpp>
+
+namespace xregex::engine
+{
+
+/**
+ * @brief Matches a fixed-length sequence of classes using Backward
+ *        Nondeterministic DAWG Matching (BNDM).
+ *
+ * A window the length of the pattern is read from right to left while
+ * tracking, in parallel, every pattern factor that the bytes read so far
+ * could belong to. As soon as no factor remains the window is shifted past
+ * the bytes read, up to the full pattern length, so most input bytes are
+ * never inspected.
+ *
+ * This suits patterns such as `${DIGIT}${DIGIT}-${DIGIT}${DIGIT}`, which have
+ * no literal to prefilter on. Patterns whose classes are broad (for example
+ * exclusion-only classes) rarely skip, in which case `ShiftAnd` is faster.
+ *
+ */
+class Bndm final
+{
+public:
+
+    /// The pattern type accepted by the matcher, one class per position
+    typedef std::vector<common::ByteClass> Pattern;
+
+    /// The set of live pattern factors, one bit per pattern position
+    typedef uint64_t State;
+
+    /// The longest pattern that fits in a single state word
+    static constexpr size_t MAX_LENGTH = 64;
+
+private:
+
+    /// The reversed positions whose class contains each byte value
+    std::array<State, common::ByteClass::SIZE> _masks;
+
+    /// The bit of the first position, set when a pattern prefix is read
+    State _prefix;
+
+    /// The number of positions in the pattern
+    size_t _length;
+
+public:
+
+    /**
+     * @brief Compile a pattern into its reversed mask table.
+     *
+     * @throws std::invalid_argument If the pattern is empty.
+     * @throws std::length_error If the pattern is longer than `MAX_LENGTH`.
+     *
+     * @param pattern The class of each position in the pattern.
+     */
+    Bndm(const Pattern& pattern);
+
+
+    /**
+     * @brief Gets the pattern length.
+     *
+     * @return size_t The number of bytes covered by every match.
+     */
+    inline size_t length() const noexcept { return _length; }
+
+
+    /**
+     * @brief Find the leftmost match starting at or after an offset.
+     *
+     * @param input The input to search.
+     * @param offset The offset to begin searching from.
+     * @return std::optional<Match> The match, if one was found.
+     */
+    std::optional<Match> find(const std::string_view input, const size_t offset = 0) const;
+
+};
+
+}
@@ -0,0 +1,60 @@
+/**
+ * @file Match.hpp
+ * @brief The span of input covered by a single match.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace xregex::engine
+{
+
+/**
+ * @brief The offsets of a match within the searched input.
+ *
+ * Offsets are always relative to the start of the logical input, and the
+ * range is half-open so that `end - start` is the length of the match.
+ *
+ */
+struct Match final
+{
+    /// The offset of the first byte of the match
+    size_t start;
+
+    /// The offset one past the last byte of the match
+    size_t end;
+
+    /**
+     * @brief Gets the length of the match.
+     *
+     * @return size_t The number of bytes covered by the match.
+     */
+    inline size_t length() const noexcept { return end - start; }
+
+    /**
+     * @brief Equality operator.
+     *
+     * @param other The other instance.
+     * @return bool Whether both matches cover the same span.
+     */
+    inline bool operator==(const Match& other) const noexcept
+    {
+        return start == other.start && end == other.end;
+    }
+
+    /**
+     * @brief Inequality operator.
+     *
+     * @param other The other instance.
+     * @return bool Whether the matches cover different spans.
+     */
+    inline bool operator!=(const Match& other) const noexcept { return !(*this == other); }
+};
+
+}
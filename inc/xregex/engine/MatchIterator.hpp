@@ -0,0 +1,188 @@
+/**
+ * @file MatchIterator.hpp
+ * @brief Lazy iteration over the successive matches in an input.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string_view>
+
+#include <xregex/engine/Match.hpp>
+
+namespace xregex::engine
+{
+
+/**
+ * @brief An input iterator yielding non-overlapping matches on demand.
+ *
+ * Each increment resumes the search from the end of the current match, so
+ * the input is only scanned as far as the matches actually consumed. A
+ * default-constructed iterator is the end of every range.
+ *
+ * @tparam Matcher The matcher type. It must provide
+ *                 `find(std::string_view, size_t)` returning
+ *                 `std::optional<Match>`, and never report empty matches.
+ */
+template <class Matcher>
+class MatchIterator final
+{
+public:
+
+    typedef std::input_iterator_tag iterator_category;
+    typedef Match value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const Match* pointer;
+    typedef const Match& reference;
+
+private:
+
+    /// The matcher being run, or `nullptr` for the end iterator
+    const Matcher* _matcher;
+
+    /// The input being searched
+    std::string_view _input;
+
+    /// The current match, or `std::nullopt` once the input is exhausted
+    std::optional<Match> _match;
+
+public:
+
+    /**
+     * @brief Construct the end iterator.
+     *
+     */
+    MatchIterator(): _matcher(nullptr) { }
+
+    /**
+     * @brief Construct an iterator positioned at the first match.
+     *
+     * @param matcher The matcher to run, which must outlive the iterator.
+     * @param input The input to search, which must outlive the iterator.
+     */
+    MatchIterator(const Matcher& matcher, const std::string_view input):
+        _matcher(&matcher),
+        _input(input),
+        _match(matcher.find(input))
+    { }
+
+
+    /**
+     * @brief Dereference operator.
+     *
+     * @return reference The current match.
+     */
+    inline reference operator*() const noexcept { return *_match; }
+
+    /**
+     * @brief Member access operator.
+     *
+     * @return pointer The current match.
+     */
+    inline pointer operator->() const noexcept { return &*_match; }
+
+    /**
+     * @brief Advance to the next match.
+     *
+     * @return MatchIterator& This instance.
+     */
+    MatchIterator& operator++()
+    {
+        _match = _matcher->find(_input, _match->end);
+        return *this;
+    }
+
+    /**
+     * @brief Advance to the next match.
+     *
+     * @return MatchIterator The iterator before advancing.
+     */
+    MatchIterator operator++(int)
+    {
+        MatchIterator previous = *this;
+        ++*this;
+        return previous;
+    }
+
+
+    /**
+     * @brief Equality operator.
+     *
+     * @param other The other instance.
+     * @return bool Whether both iterators are exhausted, or at the same match
+     *              of the same input.
+     */
+    inline bool operator==(const MatchIterator& other) const noexcept
+    {
+        return _match == other._match && (!_match || _input.data() == other._input.data());
+    }
+
+    /**
+     * @brief Inequality operator.
+     *
+     * @param other The other instance.
+     * @return bool Whether the iterators are at different matches.
+     */
+    inline bool operator!=(const MatchIterator& other) const noexcept { return !(*this == other); }
+
+};
+
+
+/**
+ * @brief The range of matches produced by `find_iter`, for use in
+ *        range-based `for` loops.
+ *
+ * Nothing is searched until the range is iterated, and stopping early
+ * leaves the rest of the input unscanned.
+ *
+ * @tparam Matcher The matcher type, as for `MatchIterator`.
+ */
+template <class Matcher>
+class MatchRange final
+{
+private:
+
+    /// The matcher being run
+    const Matcher* _matcher;
+
+    /// The input being searched
+    std::string_view _input;
+
+public:
+
+    /**
+     * @brief Construct a range over the matches in an input.
+     *
+     * @param matcher The matcher to run, which must outlive the range.
+     * @param input The input to search, which must outlive the range.
+     */
+    MatchRange(const Matcher& matcher, const std::string_view input):
+        _matcher(&matcher),
+        _input(input)
+    { }
+
+
+    /**
+     * @brief Gets an iterator at the first match.
+     *
+     * @return MatchIterator<Matcher> The first match, or the end.
+     */
+    inline MatchIterator<Matcher> begin() const { return MatchIterator<Matcher>(*_matcher, _input); }
+
+    /**
+     * @brief Gets the end iterator.
+     *
+     * @return MatchIterator<Matcher> The end of the range.
+     */
+    inline MatchIterator<Matcher> end() const noexcept { return MatchIterator<Matcher>(); }
+
+};
+
+}
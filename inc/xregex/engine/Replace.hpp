@@ -0,0 +1,98 @@
+/**
+ * @file Replace.hpp
+ * @brief Substitution of matches into an output sink.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include <xregex/engine/Match.hpp>
+
+namespace xregex::engine
+{
+
+/**
+ * @brief Replace the first match in an input, writing the result to a sink.
+ *
+ * @tparam Matcher The matcher type, providing `find(std::string_view, size_t)`.
+ * @tparam Sink The output type, providing `append(const char*, size_t)`,
+ *              such as `std::string`.
+ * @param matcher The matcher to run.
+ * @param input The input to rewrite.
+ * @param replacement The text written in place of the match.
+ * @param output The sink to append the rewritten input to.
+ * @return bool Whether a match was replaced.
+ */
+template <class Matcher, class Sink>
+bool replace
+(
+    const Matcher& matcher,
+    const std::string_view input,
+    const std::string_view replacement,
+    Sink& output
+)
+{
+    const auto match = matcher.find(input, 0);
+
+    if( !match )
+    {
+        output.append(input.data(), input.size());
+        return false;
+    }
+
+    output.append(input.data(), match->start);
+    output.append(replacement.data(), replacement.size());
+    output.append(input.data() + match->end, input.size() - match->end);
+    return true;
+}
+
+
+/**
+ * @brief Replace every non-overlapping match in an input, writing the
+ *        result to a sink.
+ *
+ * The unmatched input between matches is appended as whole runs rather
+ * than byte by byte, and nothing is allocated beyond what the sink needs
+ * to grow.
+ *
+ * @tparam Matcher The matcher type, providing `find(std::string_view, size_t)`.
+ * @tparam Sink The output type, providing `append(const char*, size_t)`,
+ *              such as `std::string`.
+ * @param matcher The matcher to run.
+ * @param input The input to rewrite.
+ * @param replacement The text written in place of each match.
+ * @param output The sink to append the rewritten input to.
+ * @return size_t The number of matches replaced.
+ */
+template <class Matcher, class Sink>
+size_t replace_all
+(
+    const Matcher& matcher,
+    const std::string_view input,
+    const std::string_view replacement,
+    Sink& output
+)
+{
+    size_t count = 0;
+    size_t copied = 0;
+
+    while( const auto match = matcher.find(input, copied) )
+    {
+        output.append(input.data() + copied, match->start - copied);
+        output.append(replacement.data(), replacement.size());
+        copied = match->end;
+        ++count;
+    }
+
+    output.append(input.data() + copied, input.size() - copied);
+    return count;
+}
+
+}
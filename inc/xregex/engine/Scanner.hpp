@@ -0,0 +1,98 @@
+/**
+ * @file Scanner.hpp
+ * @brief A resumable matcher for input that arrives in chunks.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <xregex/engine/Match.hpp>
+#include <xregex/engine/ShiftAnd.hpp>
+
+namespace xregex::engine
+{
+
+/**
+ * @brief Runs a `ShiftAnd` matcher over a stream delivered in arbitrary
+ *        chunks, such as socket reads.
+ *
+ * The automaton state and the absolute stream offset are kept between
+ * chunks, so a match that spans a chunk boundary is still found and every
+ * match is reported relative to the start of the stream. Feeding a stream
+ * chunk by chunk reports exactly the matches `ShiftAnd::find_all` would
+ * report for the whole stream, and no input is buffered.
+ *
+ * The scanner refers to its matcher, which must outlive it.
+ *
+ */
+class Scanner final
+{
+private:
+
+    /// The matcher being run over the stream
+    const ShiftAnd* _matcher;
+
+    /// The automaton state after the last byte fed
+    ShiftAnd::State _state;
+
+    /// The absolute offset of the next byte to be fed
+    size_t _offset;
+
+public:
+
+    /**
+     * @brief Construct a scanner at the start of a new stream.
+     *
+     * @param matcher The matcher to run over the stream.
+     */
+    Scanner(const ShiftAnd& matcher);
+
+
+    /**
+     * @brief Gets the stream offset.
+     *
+     * @return size_t The number of bytes fed since the last reset.
+     */
+    inline size_t offset() const noexcept { return _offset; }
+
+
+    /**
+     * @brief Feed the next chunk of the stream.
+     *
+     * @param chunk The bytes following those already fed.
+     * @return std::vector<Match> The matches ending within this chunk.
+     */
+    std::vector<Match> feed(const std::string_view chunk);
+
+    /**
+     * @brief Feed the next chunk of the stream, writing matches into
+     *        caller-provided storage.
+     *
+     * No memory is allocated. If the storage fills up, feeding stops just
+     * after the byte ending the last match written; the bytes consumed are
+     * reflected by `offset()`, and the rest of the chunk must be fed again.
+     *
+     * @param chunk The bytes following those already fed.
+     * @param matches The storage to write the matches to.
+     * @param capacity The number of matches the storage can hold.
+     * @return size_t The number of matches written.
+     */
+    size_t feed(const std::string_view chunk, Match* matches, const size_t capacity);
+
+    /**
+     * @brief Discard the scanner state to begin a new stream.
+     *
+     */
+    void reset() noexcept;
+
+};
+
+}
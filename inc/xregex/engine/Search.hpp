@@ -0,0 +1,150 @@
+/**
+ * @file Search.hpp
+ * @brief Searches built on a matcher's leftmost `find`.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <xregex/engine/Match.hpp>
+#include <xregex/engine/MatchIterator.hpp>
+
+namespace xregex::engine
+{
+
+/**
+ * @brief Find every non-overlapping match, scanning left to right.
+ *
+ * @tparam Matcher The matcher type, providing `find(std::string_view, size_t)`.
+ * @param matcher The matcher to run.
+ * @param input The input to search.
+ * @return std::vector<Match> The matches in input order.
+ */
+template <class Matcher>
+std::vector<Match> find_all(const Matcher& matcher, const std::string_view input)
+{
+    std::vector<Match> matches;
+    size_t offset = 0;
+
+    while( const auto match = matcher.find(input, offset) )
+    {
+        matches.push_back(*match);
+        offset = match->end;
+    }
+
+    return matches;
+}
+
+
+/**
+ * @brief Find non-overlapping matches into caller-provided storage.
+ *
+ * No memory is allocated. If the storage fills up, the search can be
+ * resumed by passing the end of the last match written as the offset.
+ *
+ * @tparam Matcher The matcher type, providing `find(std::string_view, size_t)`.
+ * @param matcher The matcher to run.
+ * @param input The input to search.
+ * @param matches The storage to write the matches to.
+ * @param capacity The number of matches the storage can hold.
+ * @param offset The offset to begin searching from.
+ * @return size_t The number of matches written.
+ */
+template <class Matcher>
+size_t find_all
+(
+    const Matcher& matcher,
+    const std::string_view input,
+    Match* matches,
+    const size_t capacity,
+    size_t offset = 0
+)
+{
+    size_t count = 0;
+
+    while( count < capacity )
+    {
+        const auto match = matcher.find(input, offset);
+
+        if( !match )
+        {
+            break;
+        }
+
+        matches[count++] = *match;
+        offset = match->end;
+    }
+
+    return count;
+}
+
+
+/**
+ * @brief Lazily iterate over every non-overlapping match.
+ *
+ * Each match is searched for only when the iterator is advanced, so
+ * callers that stop early do not scan the rest of the input.
+ *
+ * @tparam Matcher The matcher type, as for `MatchIterator`.
+ * @param matcher The matcher to run, which must outlive the range.
+ * @param input The input to search, which must outlive the range.
+ * @return MatchRange<Matcher> The range of matches in input order.
+ */
+template <class Matcher>
+MatchRange<Matcher> find_iter(const Matcher& matcher, const std::string_view input)
+{
+    return MatchRange<Matcher>(matcher, input);
+}
+
+
+/**
+ * @brief Checks whether the input contains a match.
+ *
+ * Matchers with a faster dedicated search provide their own overload.
+ *
+ * @tparam Matcher The matcher type, providing `find(std::string_view, size_t)`.
+ * @param matcher The matcher to run.
+ * @param input The input to search.
+ * @return bool Whether any match exists.
+ */
+template <class Matcher>
+bool is_match(const Matcher& matcher, const std::string_view input)
+{
+    return matcher.find(input, 0).has_value();
+}
+
+
+/**
+ * @brief Count the non-overlapping matches without materializing them.
+ *
+ * Matchers with a faster dedicated search provide their own overload.
+ *
+ * @tparam Matcher The matcher type, providing `find(std::string_view, size_t)`.
+ * @param matcher The matcher to run.
+ * @param input The input to search.
+ * @return size_t The number of matches `find_all` would report.
+ */
+template <class Matcher>
+size_t count_matches(const Matcher& matcher, const std::string_view input)
+{
+    size_t count = 0;
+    size_t offset = 0;
+
+    while( const auto match = matcher.find(input, offset) )
+    {
+        ++count;
+        offset = match->end;
+    }
+
+    return count;
+}
+
+}
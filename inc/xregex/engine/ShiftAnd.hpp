@@ -0,0 +1,665 @@
+/**
+ * @file ShiftAnd.hpp
+ * @brief A bit-parallel matcher for short sequences of multimatch classes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <xregex/common/ByteClass.hpp>
+#include <xregex/engine/Match.hpp>
+
+namespace xregex::engine
+{
+
+/**
+ * @brief Whether an iterator walks contiguous `char` storage, and so can be
+ *        scanned as a pointer range by the contiguous stepping core.
+ *
+ * @tparam InputIt The iterator type.
+ */
+template <class InputIt>
+inline constexpr bool is_contiguous_char_v =
+    std::is_same_v<InputIt, char*> ||
+    std::is_same_v<InputIt, const char*> ||
+    std::is_same_v<InputIt, std::string::iterator> ||
+    std::is_same_v<InputIt, std::string::const_iterator> ||
+    std::is_same_v<InputIt, std::string_view::const_iterator> ||
+    std::is_same_v<InputIt, std::vector<char>::iterator> ||
+    std::is_same_v<InputIt, std::vector<char>::const_iterator>;
+
+/**
+ * @brief Matches a fixed-length sequence of classes using the Shift-And
+ *        simulation of its position automaton.
+ *
+ * Each position of the pattern is one bit of a machine word. The membership
+ * of every byte in every position's class is precomputed into a mask table,
+ * so advancing the automaton is a shift, an or and a table lookup per byte,
+ * with no branching on the pattern and no risk of DFA blowup.
+ *
+ * Expressions such as `${DIGIT}${DIGIT}-${DIGIT}${DIGIT}` lower directly
+ * to such a sequence once their imports are resolved.
+ *
+ */
+class ShiftAnd final
+{
+public:
+
+    /// The pattern type accepted by the matcher, one class per position
+    typedef std::vector<common::ByteClass> Pattern;
+
+    /// The automaton state, one bit per pattern position
+    typedef uint64_t State;
+
+    /// The longest pattern that fits in a single state word
+    static constexpr size_t MAX_LENGTH = 64;
+
+    /// The largest first class whose bytes are searched for directly
+    static constexpr size_t MAX_START_BYTES = 3;
+
+    /// The smallest chunk `find_all_parallel` hands to a thread by default
+    static constexpr size_t PARALLEL_MIN_CHUNK = 1 << 16;
+
+private:
+
+    /// The positions whose class contains each byte value
+    std::array<State, common::ByteClass::SIZE> _masks;
+
+    /// The bit of the final position, set when a match ends
+    State _accept;
+
+    /// The number of positions in the pattern
+    size_t _length;
+
+    /// The bytes able to start a match, if the first class is small enough
+    std::array<unsigned char, MAX_START_BYTES> _start_bytes;
+
+    /// The number of start bytes, or zero if idle input is stepped through
+    size_t _start_count;
+
+
+    /**
+     * @brief Find the next byte able to start a match.
+     *
+     * A single start byte is found with `memchr`. Two or three are tested a
+     * machine word at a time, using the usual zero-byte test on the word
+     * xored with each start byte repeated.
+     *
+     * @tparam Count The number of start bytes.
+     * @param first The beginning of the input.
+     * @param last The end of the input.
+     * @return const char* The first start byte, or `last` if there is none.
+     */
+    template <size_t Count>
+    const char* _skip(const char* first, const char* last) const;
+
+    /**
+     * @brief The contiguous stepping core, for a fixed choice of skipping.
+     *
+     * With `Skip` set, the empty state (which every byte outside the first
+     * class loops back to) jumps to the next of the `Skip` start bytes with
+     * `_skip` instead of stepping through the bytes in between.
+     *
+     * @tparam Overlapping Whether matches may overlap one another.
+     * @tparam Skip The number of start bytes to skip to from the empty
+     *              state, or zero to step through every byte.
+     * @tparam Callback A callable taking a `const Match&` and returning
+     *                  whether to keep scanning.
+     * @param state The automaton state, updated as bytes are stepped.
+     * @param first The beginning of the input.
+     * @param last The end of the input.
+     * @param offset The offset of `first` within the logical input.
+     * @param on_match The callback for each match.
+     * @return const char* The position after the last byte stepped.
+     */
+    template <bool Overlapping, size_t Skip, class Callback>
+    const char* _scan
+    (
+        State& state,
+        const char* first,
+        const char* last,
+        const size_t offset,
+        Callback& on_match
+    ) const;
+
+public:
+
+    /**
+     * @brief Compile a pattern into its mask table.
+     *
+     * @throws std::invalid_argument If the pattern is empty.
+     * @throws std::length_error If the pattern is longer than `MAX_LENGTH`.
+     *
+     * @param pattern The class of each position in the pattern.
+     */
+    ShiftAnd(const Pattern& pattern);
+
+
+    /**
+     * @brief Gets the pattern length.
+     *
+     * @return size_t The number of bytes covered by every match.
+     */
+    inline size_t length() const noexcept { return _length; }
+
+    /**
+     * @brief Gets the mask of a byte.
+     *
+     * @param byte The byte to look up.
+     * @return State The positions whose class contains the byte.
+     */
+    inline State mask(const unsigned char byte) const noexcept { return _masks[byte]; }
+
+    /**
+     * @brief Advances the automaton by a single byte.
+     *
+     * @param state The state before the byte.
+     * @param byte The next byte of input.
+     * @return State The state after the byte.
+     */
+    inline State step(const State state, const unsigned char byte) const noexcept
+    {
+        return ((state << 1) | 1) & _masks[byte];
+    }
+
+    /**
+     * @brief Checks whether a state ends a match.
+     *
+     * @param state The state to check.
+     * @return bool Whether the final position is active.
+     */
+    inline bool accepts(const State state) const noexcept { return (state & _accept) != 0; }
+
+
+    /**
+     * @brief Run the automaton over a range of input, reporting each match.
+     *
+     * This is the stepping core shared by every search. The state is carried
+     * in and out, so a search may continue across separate calls, and after
+     * each match the automaton restarts unless `Overlapping` is set.
+     *
+     * Ranges over contiguous `char` storage, whether pointers or the
+     * iterators of `std::string` and `std::vector<char>`, are scanned as
+     * `const char*` by `_scan`. When the first class has at most
+     * `MAX_START_BYTES` members, idle stretches of such input are skipped
+     * by searching for those bytes; the choice is made once per call. Larger
+     * first classes, such as `${DIGIT}`, are stepped through.
+     *
+     * @tparam Overlapping Whether matches may overlap one another.
+     * @tparam InputIt An input iterator whose value converts to `char`.
+     * @tparam Callback A callable taking a `const Match&` and returning
+     *                  whether to keep scanning.
+     * @param state The automaton state, updated as bytes are stepped.
+     * @param first The beginning of the input.
+     * @param last The end of the input.
+     * @param offset The offset of `first` within the logical input.
+     * @param on_match The callback for each match.
+     * @return InputIt The position after the last byte stepped.
+     */
+    template <bool Overlapping = false, class InputIt, class Callback>
+    InputIt scan
+    (
+        State& state,
+        InputIt first,
+        const InputIt last,
+        size_t offset,
+        Callback&& on_match
+    ) const;
+
+    /**
+     * @brief Run the automaton over a scatter-gather input, reporting each
+     *        match.
+     *
+     * The segments are stepped in order as a single logical input without
+     * being copied together, so a match may span several segments. Offsets
+     * are relative to the start of the first segment.
+     *
+     * @tparam Overlapping Whether matches may overlap one another.
+     * @tparam Callback A callable taking a `const Match&` and returning
+     *                  whether to keep scanning.
+     * @param state The automaton state, updated as bytes are stepped.
+     * @param segments The buffers making up the input.
+     * @param count The number of segments.
+     * @param offset The logical offset to begin stepping from.
+     * @param on_match The callback for each match.
+     * @return size_t The logical offset after the last byte stepped.
+     */
+    template <bool Overlapping = false, class Callback>
+    size_t scan
+    (
+        State& state,
+        const std::string_view* segments,
+        const size_t count,
+        const size_t offset,
+        Callback&& on_match
+    ) const;
+
+
+    /**
+     * @brief Find the leftmost match starting at or after an offset.
+     *
+     * @param input The input to search.
+     * @param offset The offset to begin searching from.
+     * @return std::optional<Match> The match, if one was found.
+     */
+    std::optional<Match> find(const std::string_view input, const size_t offset = 0) const;
+
+    /**
+     * @brief Find the leftmost match in a scatter-gather input starting at
+     *        or after an offset.
+     *
+     * @param segments The buffers making up the input.
+     * @param count The number of segments.
+     * @param offset The logical offset to begin searching from.
+     * @return std::optional<Match> The match, if one was found.
+     */
+    std::optional<Match> find
+    (
+        const std::string_view* segments,
+        const size_t count,
+        const size_t offset = 0
+    ) const;
+
+    /**
+     * @brief Find every non-overlapping match in a scatter-gather input.
+     *
+     * The segments are matched as a single logical input without being
+     * copied together, so a match may span several segments. Offsets are
+     * relative to the start of the first segment.
+     *
+     * @param segments The buffers making up the input.
+     * @param count The number of segments.
+     * @return std::vector<Match> The matches in input order.
+     */
+    std::vector<Match> find_all(const std::string_view* segments, const size_t count) const;
+
+    /**
+     * @brief Find every match, including those overlapping one another.
+     *
+     * All matches are reported from a single pass over the input, rather
+     * than by searching again from every offset. Since every match has the
+     * pattern length, there is at most one match ending at each offset.
+     *
+     * @param input The input to search.
+     * @return std::vector<Match> The matches ordered by their end offset.
+     */
+    std::vector<Match> find_overlapping(const std::string_view input) const;
+
+    /**
+     * @brief Find every non-overlapping match, splitting a large input
+     *        across several threads.
+     *
+     * The input is cut into chunks of at least `min_chunk` bytes. Since a
+     * match crossing into a chunk ends fewer than `length()` bytes into it,
+     * each chunk is first mapped, in parallel, from every such entry phase
+     * to the matches it yields and the phase it leaves the next chunk in.
+     * Composing the maps is a single lookup per chunk, after which only the
+     * chunks entered at a phase whose matches differ from the recorded ones
+     * are scanned again, also in parallel. The result is exactly that of
+     * `find_all`.
+     *
+     * At most `std::thread::hardware_concurrency()` threads are run, each
+     * taking every n-th chunk.
+     *
+     * @param input The input to search.
+     * @param threads The number of threads to use, at least one.
+     * @param min_chunk The smallest number of bytes to give a chunk.
+     * @return std::vector<Match> The matches in input order.
+     */
+    std::vector<Match> find_all_parallel
+    (
+        const std::string_view input,
+        const size_t threads,
+        const size_t min_chunk = PARALLEL_MIN_CHUNK
+    ) const;
+
+    /**
+     * @brief Find the lines of an input which contain a match.
+     *
+     * The input is treated as records separated by `'\n'`, located with
+     * `memchr`. Matches never span lines, and once a line matches the rest
+     * of it is skipped. If anchored, the whole line must be a match.
+     *
+     * @param input The input to search.
+     * @param anchored Whether a match must cover the entire line.
+     * @return std::vector<Match> The span of each matching line, excluding
+     *                            its newline, in input order.
+     */
+    std::vector<Match> find_lines(const std::string_view input, const bool anchored = false) const;
+
+
+    /**
+     * @brief Find the leftmost match in a range of input iterators.
+     *
+     * This accepts any single-pass range of bytes, such as
+     * `std::istreambuf_iterator` or a `std::deque<char>`. Offsets are
+     * relative to `first`.
+     *
+     * @tparam InputIt An input iterator whose value converts to `char`.
+     * @param first The beginning of the input.
+     * @param last The end of the input.
+     * @param offset The offset to begin searching from.
+     * @return std::optional<Match> The match, if one was found.
+     */
+    template <class InputIt>
+    std::optional<Match> find(InputIt first, const InputIt last, const size_t offset = 0) const;
+
+    /**
+     * @brief Find every non-overlapping match in a range of input iterators.
+     *
+     * The range is traversed once, so single-pass iterators are supported.
+     *
+     * @tparam InputIt An input iterator whose value converts to `char`.
+     * @param first The beginning of the input.
+     * @param last The end of the input.
+     * @return std::vector<Match> The matches in input order.
+     */
+    template <class InputIt>
+    std::vector<Match> find_all(InputIt first, const InputIt last) const;
+
+};
+
+
+/**
+ * @brief Checks whether the input contains a match.
+ *
+ * This overload stops at the first accepting state of the stepping core,
+ * without building a span.
+ *
+ * @param matcher The matcher to run.
+ * @param input The input to search.
+ * @return bool Whether any match exists.
+ */
+bool is_match(const ShiftAnd& matcher, const std::string_view input);
+
+/**
+ * @brief Count the non-overlapping matches without materializing them.
+ *
+ * This overload counts in a single pass of the stepping core, with no
+ * restart per match.
+ *
+ * @param matcher The matcher to run.
+ * @param input The input to search.
+ * @return size_t The number of matches `find_all` would report.
+ */
+size_t count_matches(const ShiftAnd& matcher, const std::string_view input);
+
+/**
+ * @brief Checks whether a scatter-gather input contains a match.
+ *
+ * @param matcher The matcher to run.
+ * @param segments The buffers making up the input.
+ * @param count The number of segments.
+ * @return bool Whether any match exists.
+ */
+bool is_match(const ShiftAnd& matcher, const std::string_view* segments, const size_t count);
+
+/**
+ * @brief Count the non-overlapping matches in a scatter-gather input.
+ *
+ * @param matcher The matcher to run.
+ * @param segments The buffers making up the input.
+ * @param count The number of segments.
+ * @return size_t The number of matches `find_all` would report.
+ */
+size_t count_matches(const ShiftAnd& matcher, const std::string_view* segments, const size_t count);
+
+
+template <bool Overlapping, class InputIt, class Callback>
+InputIt ShiftAnd::scan
+(
+    State& state,
+    InputIt first,
+    const InputIt last,
+    size_t offset,
+    Callback&& on_match
+) const
+{
+    if constexpr( is_contiguous_char_v<InputIt> )
+    {
+        if( first == last )
+        {
+            return first;
+        }
+
+        const char* const begin = &*first;
+        const char* const end = begin + (last - first);
+
+        const char* stop = nullptr;
+
+        switch( _start_count )
+        {
+            case 1: stop = _scan<Overlapping, 1>(state, begin, end, offset, on_match); break;
+            case 2: stop = _scan<Overlapping, 2>(state, begin, end, offset, on_match); break;
+            case 3: stop = _scan<Overlapping, 3>(state, begin, end, offset, on_match); break;
+            default: stop = _scan<Overlapping, 0>(state, begin, end, offset, on_match); break;
+        }
+
+        return first + (stop - begin);
+    }
+    else
+    {
+        while( first != last )
+        {
+            state = step(state, static_cast<char>(*first));
+            ++first;
+            ++offset;
+
+            if( accepts(state) )
+            {
+                if constexpr( !Overlapping )
+                {
+                    state = 0;
+                }
+
+                if( !on_match(Match { offset - _length, offset }) )
+                {
+                    break;
+                }
+            }
+        }
+
+        return first;
+    }
+}
+
+
+template <bool Overlapping, class Callback>
+size_t ShiftAnd::scan
+(
+    State& state,
+    const std::string_view* segments,
+    const size_t count,
+    const size_t offset,
+    Callback&& on_match
+) const
+{
+    size_t position = 0;
+    bool scanning = true;
+
+    auto forward = [&](const Match& match)
+    {
+        return scanning = on_match(match);
+    };
+
+    for( size_t index = 0; index < count && scanning; ++index )
+    {
+        const std::string_view segment = segments[index];
+        const size_t skipped = std::min(segment.size(), offset - std::min(offset, position));
+        const char* const first = segment.data() + skipped;
+        const char* const last = segment.data() + segment.size();
+
+        if( first == last )
+        {
+            position += segment.size();
+            continue;
+        }
+
+        const char* stop = scan<Overlapping>(state, first, last, position + skipped, forward);
+
+        position += stop - segment.data();
+
+        if( stop != last )
+        {
+            break;
+        }
+    }
+
+    return std::max(position, offset);
+}
+
+
+template <size_t Count>
+const char* ShiftAnd::_skip(const char* first, const char* last) const
+{
+    if constexpr( Count == 1 )
+    {
+        const void* found = std::memchr(first, _start_bytes[0], last - first);
+        return found ? static_cast<const char*>(found) : last;
+    }
+    else
+    {
+        constexpr uint64_t ONES = 0x0101010101010101;
+        constexpr uint64_t HIGHS = 0x8080808080808080;
+
+        for( ; last - first >= 8; first += 8 )
+        {
+            uint64_t word;
+            uint64_t found = 0;
+
+            std::memcpy(&word, first, sizeof(word));
+
+            for( size_t index = 0; index < Count; ++index )
+            {
+                const uint64_t difference = word ^ (ONES * _start_bytes[index]);
+                found |= (difference - ONES) & ~difference & HIGHS;
+            }
+
+            if( found )
+            {
+                break;
+            }
+        }
+
+        while( first != last && !(_masks[static_cast<unsigned char>(*first)] & 1) )
+        {
+            ++first;
+        }
+
+        return first;
+    }
+}
+
+
+template <bool Overlapping, size_t Skip, class Callback>
+const char* ShiftAnd::_scan
+(
+    State& state,
+    const char* first,
+    const char* last,
+    const size_t offset,
+    Callback& on_match
+) const
+{
+    const char* const begin = first;
+
+    while( first != last )
+    {
+        // Checking the current byte first avoids a search per byte when
+        // matches are dense
+        if constexpr( Skip != 0 )
+        {
+            if( !state && !(_masks[static_cast<unsigned char>(*first)] & 1) )
+            {
+                first = _skip<Skip>(first + 1, last);
+
+                if( first == last )
+                {
+                    return last;
+                }
+            }
+        }
+
+        state = step(state, *first++);
+
+        if( accepts(state) )
+        {
+            if constexpr( !Overlapping )
+            {
+                state = 0;
+            }
+
+            const size_t end = offset + (first - begin);
+
+            if( !on_match(Match { end - _length, end }) )
+            {
+                break;
+            }
+        }
+    }
+
+    return first;
+}
+
+
+template <class InputIt>
+std::optional<Match> ShiftAnd::find(InputIt first, const InputIt last, const size_t offset) const
+{
+    typedef typename std::iterator_traits<InputIt>::iterator_category Category;
+
+    if constexpr( std::is_base_of_v<std::random_access_iterator_tag, Category> )
+    {
+        first += std::min<size_t>(offset, last - first);
+    }
+    else
+    {
+        for( size_t skipped = 0; skipped < offset && first != last; ++skipped )
+        {
+            ++first;
+        }
+    }
+
+    State state = 0;
+    std::optional<Match> found;
+
+    scan(state, first, last, offset, [&](const Match& match)
+    {
+        found = match;
+        return false;
+    });
+
+    return found;
+}
+
+
+template <class InputIt>
+std::vector<Match> ShiftAnd::find_all(InputIt first, const InputIt last) const
+{
+    std::vector<Match> matches;
+    State state = 0;
+
+    scan(state, first, last, 0, [&](const Match& match)
+    {
+        matches.push_back(match);
+        return true;
+    });
+
+    return matches;
+}
+
+}
@@ -0,0 +1,94 @@
+/**
+ * @file Split.hpp
+ * @brief Splitting of input into fields around separators.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include <xregex/common/ByteClass.hpp>
+
+namespace xregex::engine
+{
+
+/**
+ * @brief Split an input around every byte of a separator class.
+ *
+ * This is the fast path for separators such as `${WHITESPACE}`, which are a
+ * single class: each byte is tested against the class table directly, with
+ * no automaton involved. Adjacent separators produce empty fields.
+ *
+ * The fields are views into the input, written to caller-provided storage.
+ * If there are more fields than `capacity`, the last slot receives the
+ * unsplit remainder of the input.
+ *
+ * @param input The input to split.
+ * @param separator The class of separator bytes.
+ * @param fields The storage to write the fields to.
+ * @param capacity The number of fields the storage can hold.
+ * @return size_t The number of fields written.
+ */
+size_t split
+(
+    const std::string_view input,
+    const common::ByteClass& separator,
+    std::string_view* fields,
+    const size_t capacity
+);
+
+
+/**
+ * @brief Split an input around every non-overlapping match of a matcher.
+ *
+ * This behaves as the class overload, with the separators being the
+ * matches found by `matcher`.
+ *
+ * @tparam Matcher The matcher type, providing `find(std::string_view, size_t)`.
+ * @param input The input to split.
+ * @param matcher The matcher finding the separators.
+ * @param fields The storage to write the fields to.
+ * @param capacity The number of fields the storage can hold.
+ * @return size_t The number of fields written.
+ */
+template <class Matcher>
+size_t split
+(
+    const std::string_view input,
+    const Matcher& matcher,
+    std::string_view* fields,
+    const size_t capacity
+)
+{
+    size_t count = 0;
+    size_t field_start = 0;
+
+    if( !capacity )
+    {
+        return 0;
+    }
+
+    while( count + 1 < capacity )
+    {
+        const auto match = matcher.find(input, field_start);
+
+        if( !match )
+        {
+            break;
+        }
+
+        fields[count++] = input.substr(field_start, match->start - field_start);
+        field_start = match->end;
+    }
+
+    fields[count++] = input.substr(field_start);
+    return count;
+}
+
+}
@@ -0,0 +1,77 @@
+/**
+ * @file ByteClass.cpp
+ * @brief The implementation file for the ByteClass class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <xregex/common/ByteClass.hpp>
+
+#include <stdexcept>
+
+using ByteClass = xregex::common::ByteClass;
+
+
+ByteClass::ByteClass(const char value)
+{
+    _members.set(static_cast<unsigned char>(value));
+}
+
+
+ByteClass::ByteClass
+(
+    const std::vector<Entry>& inclusions,
+    const std::vector<Entry>& exclusions
+)
+{
+    if( inclusions.empty() && exclusions.empty() )
+    {
+        throw std::invalid_argument("A multimatch class requires at least one clause");
+    }
+
+    // With no inclusion clause, every byte is assumed to be included
+    if( inclusions.empty() )
+    {
+        _members.set();
+    }
+
+    for( const Entry& entry : inclusions )
+    {
+        _apply(entry, true);
+    }
+
+    // Exclusions are applied last so that they always take precedence
+    for( const Entry& entry : exclusions )
+    {
+        _apply(entry, false);
+    }
+}
+
+
+void ByteClass::_apply(const Entry& entry, const bool value)
+{
+    typedef RangedTree<char> Tree;
+
+    if( const auto* single = std::get_if<Tree::SingleEntry>(&entry) )
+    {
+        _members.set(static_cast<unsigned char>(single->value), value);
+        return;
+    }
+
+    const auto& ranged = std::get<Tree::RangedEntry>(entry);
+    const unsigned char first = static_cast<unsigned char>(ranged.range_start);
+    const unsigned char last = static_cast<unsigned char>(ranged.range_end);
+
+    if( first > last )
+    {
+        throw std::invalid_argument("A multimatch range must not end before it starts");
+    }
+
+    for( size_t byte = first; byte <= last; ++byte )
+    {
+        _members.set(byte, value);
+    }
+}
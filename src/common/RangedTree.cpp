@@ -53,11 +53,11 @@ template <class T>
 RangedTree<T>::RangedTreeNode::RangedTreeNode(RangedTreeNode&& other) noexcept:
 _node_type(other._node_type),
 _value(other._value),
-_tree_height(other.tree_height),
+_tree_height(other._tree_height),
 _parent(other._parent)              // Preserve the parent. Worst case it's unreachable
 {
     // Make sure no self-assignment
-    if( this == *other )
+    if( this == &other )
     {
         return;
     }
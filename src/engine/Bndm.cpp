@@ -0,0 +1,88 @@
+/**
+ * @file Bndm.cpp
+ * @brief The implementation file for the Bndm class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <xregex/engine/Bndm.hpp>
+
+#include <stdexcept>
+
+using Bndm = xregex::engine::Bndm;
+using Match = xregex::engine::Match;
+
+
+Bndm::Bndm(const Pattern& pattern):
+_masks(),
+_prefix(0),
+_length(pattern.size())
+{
+    if( pattern.empty() )
+    {
+        throw std::invalid_argument("A pattern requires at least one position");
+    }
+
+    if( pattern.size() > MAX_LENGTH )
+    {
+        throw std::length_error("The pattern has too many positions for a single state word");
+    }
+
+    // The last position takes the lowest bit, since windows are read backward
+    for( size_t position = 0; position < pattern.size(); ++position )
+    {
+        for( size_t byte = 0; byte < common::ByteClass::SIZE; ++byte )
+        {
+            if( pattern[position].contains(byte) )
+            {
+                _masks[byte] |= State(1) << (_length - 1 - position);
+            }
+        }
+    }
+
+    _prefix = State(1) << (_length - 1);
+}
+
+
+std::optional<Match> Bndm::find(const std::string_view input, const size_t offset) const
+{
+    if( input.size() < _length )
+    {
+        return std::nullopt;
+    }
+
+    size_t window = offset;
+
+    while( window <= input.size() - _length )
+    {
+        size_t remaining = _length;
+        size_t shift = _length;
+        State state = ~State(0);
+
+        while( state )
+        {
+            --remaining;
+            state &= _masks[static_cast<unsigned char>(input[window + remaining])];
+
+            if( state & _prefix )
+            {
+                if( !remaining )
+                {
+                    return Match { window, window + _length };
+                }
+
+                // Remember the longest pattern prefix seen as the next window
+                shift = remaining;
+            }
+
+            state <<= 1;
+        }
+
+        window += shift;
+    }
+
+    return std::nullopt;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file Scanner.cpp
+ * @brief The implementation file for the Scanner class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <xregex/engine/Scanner.hpp>
+
+using Scanner = xregex::engine::Scanner;
+using Match = xregex::engine::Match;
+
+
+Scanner::Scanner(const ShiftAnd& matcher):
+_matcher(&matcher),
+_state(0),
+_offset(0) { }
+
+
+std::vector<Match> Scanner::feed(const std::string_view chunk)
+{
+    std::vector<Match> matches;
+
+    _matcher->scan(_state, chunk.data(), chunk.data() + chunk.size(), _offset, [&](const Match& match)
+    {
+        matches.push_back(match);
+        return true;
+    });
+
+    _offset += chunk.size();
+    return matches;
+}
+
+
+size_t Scanner::feed(const std::string_view chunk, Match* matches, const size_t capacity)
+{
+    size_t count = 0;
+
+    // A match cannot be held back once stepped, so nothing is consumed
+    if( !capacity )
+    {
+        return 0;
+    }
+
+    const char* stop = _matcher->scan(_state, chunk.data(), chunk.data() + chunk.size(), _offset, [&](const Match& match)
+    {
+        matches[count++] = match;
+        return count < capacity;
+    });
+
+    _offset += stop - chunk.data();
+    return count;
+}
+
+
+void Scanner::reset() noexcept
+{
+    _state = 0;
+    _offset = 0;
+}
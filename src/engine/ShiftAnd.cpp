@@ -0,0 +1,508 @@
+/**
+ * @file ShiftAnd.cpp
+ * @brief The implementation file for the ShiftAnd class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <xregex/engine/ShiftAnd.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+using ShiftAnd = xregex::engine::ShiftAnd;
+using Match = xregex::engine::Match;
+
+namespace
+{
+
+/**
+ * @brief Joins every thread it holds when it goes out of scope, so that no
+ *        running thread is destroyed when an exception unwinds the stack.
+ *
+ */
+struct JoinGuard final
+{
+    std::vector<std::thread> threads;
+
+    ~JoinGuard()
+    {
+        for( std::thread& thread : threads )
+        {
+            thread.join();
+        }
+    }
+};
+
+/**
+ * @brief How the non-overlapping scan of one chunk of a parallel search
+ *        continues from each of its entry phases.
+ *
+ * The entry phase is how far past the start of the chunk the sequential
+ * scan resumes, which is nonzero only when a match crosses into the chunk.
+ *
+ */
+struct ChunkMap final
+{
+    /// Marks an entry phase whose matches never agree with `leading`
+    static constexpr size_t NONE = static_cast<size_t>(-1);
+
+    /// The matches of the scan entering at phase zero
+    std::vector<Match> leading;
+
+    /// The cursor after the chunk for each entry phase
+    std::vector<size_t> exits;
+
+    /// The first match of `leading` shared by each entry phase, or `NONE`
+    std::vector<size_t> joins;
+
+    /// The entry phase of the sequential scan, once the maps are composed
+    size_t entry = 0;
+
+    /// The matches of the entry phase before it joins `leading`
+    std::vector<Match> prefix;
+};
+
+/**
+ * @brief Run a piece of work on every chunk, spreading the chunks across
+ *        threads.
+ *
+ * Each thread takes every n-th chunk, the calling thread included. The
+ * first exception thrown by any of them is rethrown once all have joined.
+ *
+ * @tparam Work A callable taking the index of a chunk.
+ * @param chunks The number of chunks.
+ * @param workers The number of threads to use, at least one.
+ * @param work The work to run on each chunk.
+ */
+template <class Work>
+void run_chunks(const size_t chunks, const size_t workers, Work& work)
+{
+    std::vector<std::exception_ptr> errors(workers);
+
+    auto run = [&](const size_t worker)
+    {
+        try
+        {
+            for( size_t chunk = worker; chunk < chunks; chunk += workers )
+            {
+                work(chunk);
+            }
+        }
+        catch( ... )
+        {
+            errors[worker] = std::current_exception();
+        }
+    };
+
+    {
+        JoinGuard guard;
+
+        for( size_t worker = 1; worker < workers; ++worker )
+        {
+            guard.threads.emplace_back(run, worker);
+        }
+
+        run(0);
+    }
+
+    for( const std::exception_ptr& error : errors )
+    {
+        if( error )
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+}
+
+
+ShiftAnd::ShiftAnd(const Pattern& pattern):
+_masks(),
+_accept(0),
+_length(pattern.size()),
+_start_bytes(),
+_start_count(0)
+{
+    if( pattern.empty() )
+    {
+        throw std::invalid_argument("A pattern requires at least one position");
+    }
+
+    if( pattern.size() > MAX_LENGTH )
+    {
+        throw std::length_error("The pattern has too many positions for a single state word");
+    }
+
+    for( size_t position = 0; position < pattern.size(); ++position )
+    {
+        for( size_t byte = 0; byte < common::ByteClass::SIZE; ++byte )
+        {
+            if( pattern[position].contains(byte) )
+            {
+                _masks[byte] |= State(1) << position;
+            }
+        }
+    }
+
+    _accept = State(1) << (_length - 1);
+
+    if( pattern.front().count() <= MAX_START_BYTES )
+    {
+        for( size_t byte = 0; byte < common::ByteClass::SIZE; ++byte )
+        {
+            if( pattern.front().contains(byte) )
+            {
+                _start_bytes[_start_count++] = byte;
+            }
+        }
+    }
+}
+
+
+std::optional<Match> ShiftAnd::find(const std::string_view input, const size_t offset) const
+{
+    State state = 0;
+    std::optional<Match> found;
+
+    if( offset >= input.size() )
+    {
+        return std::nullopt;
+    }
+
+    scan(state, input.data() + offset, input.data() + input.size(), offset, [&](const Match& match)
+    {
+        found = match;
+        return false;
+    });
+
+    return found;
+}
+
+
+std::optional<Match> ShiftAnd::find
+(
+    const std::string_view* segments,
+    const size_t count,
+    const size_t offset
+) const
+{
+    State state = 0;
+    std::optional<Match> found;
+
+    scan(state, segments, count, offset, [&](const Match& match)
+    {
+        found = match;
+        return false;
+    });
+
+    return found;
+}
+
+
+std::vector<Match> ShiftAnd::find_all(const std::string_view* segments, const size_t count) const
+{
+    std::vector<Match> matches;
+    State state = 0;
+
+    scan(state, segments, count, 0, [&](const Match& match)
+    {
+        matches.push_back(match);
+        return true;
+    });
+
+    return matches;
+}
+
+
+std::vector<Match> ShiftAnd::find_overlapping(const std::string_view input) const
+{
+    std::vector<Match> matches;
+    State state = 0;
+
+    scan<true>(state, input.data(), input.data() + input.size(), 0, [&](const Match& match)
+    {
+        matches.push_back(match);
+        return true;
+    });
+
+    return matches;
+}
+
+
+std::vector<Match> ShiftAnd::find_all_parallel
+(
+    const std::string_view input,
+    const size_t threads,
+    const size_t min_chunk
+) const
+{
+    const size_t chunk_floor = std::max<size_t>(1, min_chunk);
+    const size_t chunks = std::max<size_t>(1, std::min(threads, (input.size() + chunk_floor - 1) / chunk_floor));
+    const size_t chunk_size = (input.size() + chunks - 1) / chunks;
+    const size_t workers = std::min<size_t>(chunks, std::max(1u, std::thread::hardware_concurrency()));
+
+    std::vector<ChunkMap> maps(chunks);
+
+    auto chunk_begin = [&](const size_t chunk)
+    {
+        return std::min(input.size(), chunk * chunk_size);
+    };
+
+    auto chunk_end = [&](const size_t chunk)
+    {
+        return std::min(input.size(), (chunk + 1) * chunk_size);
+    };
+
+    // Matches starting inside a chunk may end up to `_length - 1` bytes past it
+    auto window_end = [&](const size_t chunk)
+    {
+        return std::min(input.size(), chunk_end(chunk) + _length - 1);
+    };
+
+    // A match ending a chunk leaves the next chunk to resume at one of
+    // `_length` entry phases. Every phase is followed at once over the
+    // overlapping matches: each phase takes the next match starting at or
+    // after its cursor, and phases taking the same match agree from then on.
+    auto map_chunk = [&](const size_t chunk)
+    {
+        struct Chain
+        {
+            size_t cursor;
+            State phases;
+        };
+
+        const size_t begin = chunk_begin(chunk);
+        const size_t end = chunk_end(chunk);
+        ChunkMap& map = maps[chunk];
+
+        std::array<Chain, MAX_LENGTH> chains;
+        size_t head = 0;
+        size_t live = _length;
+        State joined = 1;
+
+        map.exits.assign(_length, 0);
+        map.joins.assign(_length, ChunkMap::NONE);
+        map.joins[0] = 0;
+
+        for( size_t phase = 0; phase < _length; ++phase )
+        {
+            chains[phase] = Chain { begin + phase, State(1) << phase };
+        }
+
+        State state = 0;
+
+        scan<true>(state, input.data() + begin, input.data() + window_end(chunk), begin, [&](const Match& match)
+        {
+            if( match.start >= end )
+            {
+                return false;
+            }
+
+            State phases = 0;
+
+            while( live && chains[head].cursor <= match.start )
+            {
+                phases |= chains[head].phases;
+                head = (head + 1) % MAX_LENGTH;
+                --live;
+            }
+
+            if( !phases )
+            {
+                return true;
+            }
+
+            // The phases joining the first phase's chain share its matches from here
+            if( phases & 1 )
+            {
+                for( size_t phase = 1; phase < _length; ++phase )
+                {
+                    if( (phases & ~joined) >> phase & 1 )
+                    {
+                        map.joins[phase] = map.leading.size();
+                    }
+                }
+
+                joined |= phases;
+                map.leading.push_back(match);
+            }
+
+            chains[(head + live++) % MAX_LENGTH] = Chain { match.end, phases };
+            return true;
+        });
+
+        for( ; live; head = (head + 1) % MAX_LENGTH, --live )
+        {
+            for( size_t phase = 0; phase < _length; ++phase )
+            {
+                if( chains[head].phases >> phase & 1 )
+                {
+                    map.exits[phase] = chains[head].cursor;
+                }
+            }
+        }
+    };
+
+    // Matches of an entry phase which never joined, or joined late, the
+    // first phase's chain are found by scanning again from its cursor
+    auto resolve_chunk = [&](const size_t chunk)
+    {
+        ChunkMap& map = maps[chunk];
+        const size_t join = map.joins[map.entry];
+
+        if( !join )
+        {
+            return;
+        }
+
+        const size_t from = std::min(window_end(chunk), chunk_begin(chunk) + map.entry);
+        const size_t limit = join == ChunkMap::NONE ? chunk_end(chunk) : map.leading[join].start;
+
+        State state = 0;
+
+        scan(state, input.data() + from, input.data() + window_end(chunk), from, [&](const Match& match)
+        {
+            if( match.start >= limit )
+            {
+                return false;
+            }
+
+            map.prefix.push_back(match);
+            return true;
+        });
+    };
+
+    run_chunks(chunks, workers, map_chunk);
+
+    // Composing the maps in order is the only serial step, one lookup per chunk
+    bool resolving = false;
+    size_t entry = 0;
+
+    for( size_t chunk = 0; chunk < chunks; ++chunk )
+    {
+        const size_t end = chunk_end(chunk);
+
+        maps[chunk].entry = entry;
+        resolving = resolving || maps[chunk].joins[entry] != 0;
+        entry = std::max(end, maps[chunk].exits[entry]) - end;
+    }
+
+    if( resolving )
+    {
+        run_chunks(chunks, workers, resolve_chunk);
+    }
+
+    std::vector<Match> matches;
+
+    for( const ChunkMap& map : maps )
+    {
+        const size_t join = std::min(map.joins[map.entry], map.leading.size());
+
+        matches.insert(matches.end(), map.prefix.begin(), map.prefix.end());
+        matches.insert(matches.end(), map.leading.begin() + join, map.leading.end());
+    }
+
+    return matches;
+}
+
+
+std::vector<Match> ShiftAnd::find_lines(const std::string_view input, const bool anchored) const
+{
+    std::vector<Match> lines;
+    size_t line_start = 0;
+
+    // An empty input may have no buffer at all, and its one line is too
+    // short to match
+    if( input.empty() )
+    {
+        return lines;
+    }
+
+    while( line_start <= input.size() )
+    {
+        const char* newline = static_cast<const char*>
+        (
+            std::memchr(input.data() + line_start, '\n', input.size() - line_start)
+        );
+
+        const size_t line_end = newline ? newline - input.data() : input.size();
+        const std::string_view line = input.substr(line_start, line_end - line_start);
+
+        const bool matched = anchored ?
+            line.size() == _length && is_match(*this, line) :
+            is_match(*this, line);
+
+        if( matched )
+        {
+            lines.push_back(Match { line_start, line_end });
+        }
+
+        if( !newline )
+        {
+            break;
+        }
+
+        line_start = line_end + 1;
+    }
+
+    return lines;
+}
+
+
+bool xregex::engine::is_match(const ShiftAnd& matcher, const std::string_view input)
+{
+    ShiftAnd::State state = 0;
+    bool matched = false;
+
+    matcher.scan(state, input.data(), input.data() + input.size(), 0, [&](const Match&)
+    {
+        matched = true;
+        return false;
+    });
+
+    return matched;
+}
+
+
+size_t xregex::engine::count_matches(const ShiftAnd& matcher, const std::string_view input)
+{
+    ShiftAnd::State state = 0;
+    size_t count = 0;
+
+    matcher.scan(state, input.data(), input.data() + input.size(), 0, [&](const Match&)
+    {
+        ++count;
+        return true;
+    });
+
+    return count;
+}
+
+
+bool xregex::engine::is_match(const ShiftAnd& matcher, const std::string_view* segments, const size_t count)
+{
+    return matcher.find(segments, count).has_value();
+}
+
+
+size_t xregex::engine::count_matches(const ShiftAnd& matcher, const std::string_view* segments, const size_t count)
+{
+    ShiftAnd::State state = 0;
+    size_t matches = 0;
+
+    matcher.scan(state, segments, count, 0, [&](const Match&)
+    {
+        ++matches;
+        return true;
+    });
+
+    return matches;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file Split.cpp
+ * @brief The implementation file for input splitting.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <xregex/engine/Split.hpp>
+
+
+size_t xregex::engine::split
+(
+    const std::string_view input,
+    const common::ByteClass& separator,
+    std::string_view* fields,
+    const size_t capacity
+)
+{
+    size_t count = 0;
+    size_t field_start = 0;
+
+    if( !capacity )
+    {
+        return 0;
+    }
+
+    for( size_t index = 0; index < input.size() && count + 1 < capacity; ++index )
+    {
+        if( separator.contains(input[index]) )
+        {
+            fields[count++] = input.substr(field_start, index - field_start);
+            field_start = index + 1;
+        }
+    }
+
+    fields[count++] = input.substr(field_start);
+    return count;
+}
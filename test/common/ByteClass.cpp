@@ -0,0 +1,76 @@
+/**
+ * @file ByteClass.cpp
+ * @brief Test file for byte class
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <xregex/common/ByteClass.hpp>
+
+using xregex::common::ByteClass;
+
+typedef std::pair<const char, const char> Range;
+
+TEST(ByteClass, Literal)
+{
+    const ByteClass dash('-');
+
+    ASSERT_TRUE(dash['-']);
+    ASSERT_FALSE(dash['+']);
+    ASSERT_EQ(dash.count(), 1);
+}
+
+TEST(ByteClass, Inclusion)
+{
+    const ByteClass word({ Range('a', 'z'), Range('0', '9'), '_' });
+
+    ASSERT_TRUE(word['a']);
+    ASSERT_TRUE(word['z']);
+    ASSERT_TRUE(word['5']);
+    ASSERT_TRUE(word['_']);
+    ASSERT_FALSE(word['A']);
+    ASSERT_EQ(word.count(), 37);
+}
+
+TEST(ByteClass, InclusionExclusion)
+{
+    const ByteClass letters({ Range('a', 'z') }, { 'b' });
+
+    ASSERT_TRUE(letters['a']);
+    ASSERT_FALSE(letters['b']);
+    ASSERT_TRUE(letters['c']);
+    ASSERT_EQ(letters.count(), 25);
+}
+
+TEST(ByteClass, ExclusionOnly)
+{
+    const ByteClass unquoted({}, { '"' });
+
+    ASSERT_FALSE(unquoted['"']);
+    ASSERT_TRUE(unquoted['a']);
+    ASSERT_TRUE(unquoted[0xff]);
+    ASSERT_EQ(unquoted.count(), 255);
+}
+
+TEST(ByteClass, HighBytes)
+{
+    const ByteClass high({ Range('\x80', '\xff') });
+
+    ASSERT_TRUE(high[0x80]);
+    ASSERT_TRUE(high[0xff]);
+    ASSERT_FALSE(high[0x7f]);
+    ASSERT_EQ(high.count(), 128);
+}
+
+TEST(ByteClass, Invalid)
+{
+    ASSERT_THROW(ByteClass({}, {}), std::invalid_argument);
+    ASSERT_THROW(ByteClass({ Range('z', 'a') }), std::invalid_argument);
+}
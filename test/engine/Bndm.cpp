@@ -0,0 +1,83 @@
+/**
+ * @file Bndm.cpp
+ * @brief Test file for BNDM matcher
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <stdexcept>
+
+#include <xregex/engine/Bndm.hpp>
+#include <xregex/engine/Search.hpp>
+#include <xregex/engine/ShiftAnd.hpp>
+
+using xregex::common::ByteClass;
+using xregex::engine::Bndm;
+using xregex::engine::Match;
+using xregex::engine::ShiftAnd;
+
+typedef std::pair<const char, const char> Range;
+
+static const ByteClass DIGIT({ Range('0', '9') });
+
+TEST(Bndm, Find)
+{
+    const Bndm matcher({ DIGIT, DIGIT, '-', DIGIT, DIGIT });
+
+    ASSERT_EQ(matcher.length(), 5);
+    ASSERT_EQ(matcher.find("id 12-34 ok"), (Match { 3, 8 }));
+    ASSERT_EQ(matcher.find("12-34"), (Match { 0, 5 }));
+    ASSERT_EQ(matcher.find("1-23 12-3"), std::nullopt);
+    ASSERT_EQ(matcher.find("12-"), std::nullopt);
+}
+
+TEST(Bndm, FindOffset)
+{
+    const Bndm matcher({ DIGIT, DIGIT });
+
+    ASSERT_EQ(matcher.find("12 34", 1), (Match { 3, 5 }));
+    ASSERT_EQ(matcher.find("12 34", 4), std::nullopt);
+}
+
+TEST(Bndm, AgreesWithShiftAnd)
+{
+    const ByteClass AB({ Range('a', 'b') });
+    const std::vector<ByteClass> pattern { 'a', AB, 'b', AB, 'a' };
+    const Bndm bndm(pattern);
+    const ShiftAnd shift_and(pattern);
+
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> letter('a', 'c');
+
+    for( size_t trial = 0; trial < 200; ++trial )
+    {
+        std::string input(trial, ' ');
+        for( char& byte : input )
+        {
+            byte = static_cast<char>(letter(generator));
+        }
+
+        ASSERT_EQ(find_all(bndm, input), find_all(shift_and, input)) << input;
+    }
+}
+
+TEST(Bndm, LongestPattern)
+{
+    const Bndm::Pattern pattern(Bndm::MAX_LENGTH, ByteClass('x'));
+    const Bndm matcher(pattern);
+    const std::string input = "y" + std::string(Bndm::MAX_LENGTH, 'x');
+
+    ASSERT_EQ(matcher.find(input), (Match { 1, input.size() }));
+}
+
+TEST(Bndm, Invalid)
+{
+    ASSERT_THROW(Bndm(Bndm::Pattern()), std::invalid_argument);
+    ASSERT_THROW(Bndm(Bndm::Pattern(Bndm::MAX_LENGTH + 1, ByteClass('x'))), std::length_error);
+}
@@ -0,0 +1,78 @@
+/**
+ * @file Replace.cpp
+ * @brief Test file for match substitution
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <xregex/engine/Bndm.hpp>
+#include <xregex/engine/Replace.hpp>
+#include <xregex/engine/ShiftAnd.hpp>
+
+using xregex::common::ByteClass;
+using xregex::engine::Bndm;
+using xregex::engine::ShiftAnd;
+using xregex::engine::replace;
+using xregex::engine::replace_all;
+
+typedef std::pair<const char, const char> Range;
+
+static const ByteClass DIGIT({ Range('0', '9') });
+
+/**
+ * @brief A sink which only records how many bytes were written.
+ *
+ */
+struct CountingSink final
+{
+    size_t written = 0;
+
+    void append(const char*, const size_t size) { written += size; }
+};
+
+TEST(Replace, Replace)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT });
+    std::string output;
+
+    ASSERT_TRUE(replace(matcher, "a 12 34", "##", output));
+    ASSERT_EQ(output, "a ## 34");
+
+    output.clear();
+    ASSERT_FALSE(replace(matcher, "a 1 3", "##", output));
+    ASSERT_EQ(output, "a 1 3");
+}
+
+TEST(Replace, ReplaceAll)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT, '-', DIGIT, DIGIT });
+    std::string output = "> ";
+
+    ASSERT_EQ(replace_all(matcher, "from 12-34 to 56-78.", "XX-XX", output), 2);
+    ASSERT_EQ(output, "> from XX-XX to XX-XX.");
+}
+
+TEST(Replace, ReplaceAllBndm)
+{
+    const Bndm matcher({ DIGIT, DIGIT });
+    std::string output;
+
+    ASSERT_EQ(replace_all(matcher, "12345", "", output), 2);
+    ASSERT_EQ(output, "5");
+}
+
+TEST(Replace, Sink)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT });
+    CountingSink sink;
+
+    ASSERT_EQ(replace_all(matcher, "12 34 5", "#", sink), 2);
+    ASSERT_EQ(sink.written, 5);
+}
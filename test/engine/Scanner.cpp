@@ -0,0 +1,88 @@
+/**
+ * @file Scanner.cpp
+ * @brief Test file for chunked scanner
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include <xregex/engine/Scanner.hpp>
+#include <xregex/engine/Search.hpp>
+
+using xregex::common::ByteClass;
+using xregex::engine::Match;
+using xregex::engine::Scanner;
+using xregex::engine::ShiftAnd;
+
+typedef std::pair<const char, const char> Range;
+
+static const ByteClass DIGIT({ Range('0', '9') });
+
+TEST(Scanner, SpanningChunks)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT, '-', DIGIT, DIGIT });
+    Scanner scanner(matcher);
+
+    ASSERT_TRUE(scanner.feed("id 1").empty());
+    ASSERT_TRUE(scanner.feed("2-").empty());
+    ASSERT_EQ(scanner.feed("34 ok"), (std::vector<Match> { { 3, 8 } }));
+    ASSERT_EQ(scanner.offset(), 11);
+}
+
+TEST(Scanner, AgreesWithFindAll)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT });
+    const std::string input = "12345 67 8 90";
+
+    for( size_t size = 1; size <= input.size(); ++size )
+    {
+        Scanner scanner(matcher);
+        std::vector<Match> matches;
+
+        for( size_t offset = 0; offset < input.size(); offset += size )
+        {
+            const auto found = scanner.feed(std::string_view(input).substr(offset, size));
+            matches.insert(matches.end(), found.begin(), found.end());
+        }
+
+        ASSERT_EQ(matches, find_all(matcher, input)) << size;
+    }
+}
+
+TEST(Scanner, Storage)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT });
+    const std::string_view chunk = "12345 67";
+    Scanner scanner(matcher);
+    std::array<Match, 2> matches;
+
+    ASSERT_EQ(scanner.feed(chunk, matches.data(), 0), 0);
+    ASSERT_EQ(scanner.offset(), 0);
+
+    ASSERT_EQ(scanner.feed(chunk, matches.data(), matches.size()), 2);
+    ASSERT_EQ(matches[0], (Match { 0, 2 }));
+    ASSERT_EQ(matches[1], (Match { 2, 4 }));
+    ASSERT_EQ(scanner.offset(), 4);
+
+    ASSERT_EQ(scanner.feed(chunk.substr(scanner.offset()), matches.data(), matches.size()), 1);
+    ASSERT_EQ(matches[0], (Match { 6, 8 }));
+    ASSERT_EQ(scanner.offset(), chunk.size());
+}
+
+TEST(Scanner, Reset)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT });
+    Scanner scanner(matcher);
+
+    scanner.feed("a1");
+    scanner.reset();
+
+    ASSERT_EQ(scanner.offset(), 0);
+    ASSERT_TRUE(scanner.feed("2").empty());
+}
@@ -0,0 +1,100 @@
+/**
+ * @file Search.cpp
+ * @brief Test file for the searches shared by every matcher
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include <xregex/engine/Bndm.hpp>
+#include <xregex/engine/Search.hpp>
+#include <xregex/engine/ShiftAnd.hpp>
+
+using xregex::common::ByteClass;
+using xregex::engine::Bndm;
+using xregex::engine::Match;
+using xregex::engine::ShiftAnd;
+
+typedef std::pair<const char, const char> Range;
+
+static const ByteClass DIGIT({ Range('0', '9') });
+
+/**
+ * @brief Runs each search against every matcher type.
+ *
+ * @tparam Matcher The matcher type under test.
+ */
+template <class Matcher>
+class Search : public ::testing::Test { };
+
+typedef ::testing::Types<ShiftAnd, Bndm> Matchers;
+TYPED_TEST_SUITE(Search, Matchers);
+
+TYPED_TEST(Search, FindAll)
+{
+    const TypeParam matcher({ DIGIT, DIGIT });
+    const std::vector<Match> expected { { 0, 2 }, { 2, 4 }, { 6, 8 } };
+
+    ASSERT_EQ(find_all(matcher, "12345 67"), expected);
+    ASSERT_TRUE(find_all(matcher, "a1b2").empty());
+}
+
+TYPED_TEST(Search, FindAllStorage)
+{
+    const TypeParam matcher({ DIGIT, DIGIT });
+    std::array<Match, 2> matches;
+
+    ASSERT_EQ(find_all(matcher, "12345 67", matches.data(), matches.size()), 2);
+    ASSERT_EQ(matches[0], (Match { 0, 2 }));
+    ASSERT_EQ(matches[1], (Match { 2, 4 }));
+
+    ASSERT_EQ(find_all(matcher, "12345 67", matches.data(), matches.size(), matches[1].end), 1);
+    ASSERT_EQ(matches[0], (Match { 6, 8 }));
+
+    ASSERT_EQ(find_all(matcher, "12345 67", matches.data(), 0), 0);
+}
+
+TYPED_TEST(Search, FindIter)
+{
+    const TypeParam matcher({ DIGIT, DIGIT });
+    std::vector<Match> matches;
+
+    for( const Match& match : find_iter(matcher, "12345 67") )
+    {
+        matches.push_back(match);
+    }
+
+    ASSERT_EQ(matches, find_all(matcher, "12345 67"));
+
+    const auto range = find_iter(matcher, "12345 67");
+    auto iterator = range.begin();
+    ASSERT_EQ(*iterator++, (Match { 0, 2 }));
+    ASSERT_EQ(iterator->start, 2);
+    ASSERT_TRUE(find_iter(matcher, "a1b2").begin() == find_iter(matcher, "a1b2").end());
+
+    const std::string first = "12", second = "12";
+    ASSERT_TRUE(find_iter(matcher, first).begin() != find_iter(matcher, second).begin());
+}
+
+TYPED_TEST(Search, IsMatch)
+{
+    const TypeParam matcher({ DIGIT, DIGIT, '-', DIGIT, DIGIT });
+
+    ASSERT_TRUE(is_match(matcher, "id 12-34 ok"));
+    ASSERT_FALSE(is_match(matcher, "1-23 12-3"));
+    ASSERT_FALSE(is_match(matcher, ""));
+}
+
+TYPED_TEST(Search, CountMatches)
+{
+    const TypeParam matcher({ DIGIT, DIGIT });
+
+    ASSERT_EQ(count_matches(matcher, "12345 67"), 3);
+    ASSERT_EQ(count_matches(matcher, "a1b2"), 0);
+}
@@ -0,0 +1,266 @@
+/**
+ * @file ShiftAnd.cpp
+ * @brief Test file for shift-and matcher
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <deque>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+#include <xregex/engine/Search.hpp>
+#include <xregex/engine/ShiftAnd.hpp>
+
+using xregex::common::ByteClass;
+using xregex::engine::Match;
+using xregex::engine::ShiftAnd;
+
+typedef std::pair<const char, const char> Range;
+
+static const ByteClass DIGIT({ Range('0', '9') });
+
+/**
+ * @brief Count the overlapping matches through the generic stepping core.
+ *
+ * @param matcher The matcher to run.
+ * @param input The input to search.
+ * @return size_t The number of overlapping matches.
+ */
+static size_t count_overlapping(const ShiftAnd& matcher, const std::deque<char>& input)
+{
+    ShiftAnd::State state = 0;
+    size_t count = 0;
+
+    matcher.scan<true>(state, input.begin(), input.end(), 0, [&](const Match&)
+    {
+        ++count;
+        return true;
+    });
+
+    return count;
+}
+
+TEST(ShiftAnd, Find)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT, '-', DIGIT, DIGIT });
+
+    ASSERT_EQ(matcher.length(), 5);
+    ASSERT_EQ(matcher.find("id 12-34 ok"), (Match { 3, 8 }));
+    ASSERT_EQ(matcher.find("1-23 12-3"), std::nullopt);
+}
+
+TEST(ShiftAnd, FindOffset)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT });
+
+    ASSERT_EQ(matcher.find("12 34", 1), (Match { 3, 5 }));
+    ASSERT_EQ(matcher.find("12 34", 4), std::nullopt);
+}
+
+TEST(ShiftAnd, FindOverlapping)
+{
+    const ShiftAnd matcher({ 'a', 'b', 'a' });
+    const std::vector<Match> expected { { 0, 3 }, { 2, 5 }, { 6, 9 } };
+
+    ASSERT_EQ(matcher.find_overlapping("ababaxaba"), expected);
+    ASSERT_EQ(find_all(matcher, "ababaxaba"), (std::vector<Match> { { 0, 3 }, { 6, 9 } }));
+    ASSERT_TRUE(matcher.find_overlapping("ab").empty());
+}
+
+TEST(ShiftAnd, FindAllParallel)
+{
+    const ShiftAnd matcher({ 'a', 'b', 'a' });
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> letter('a', 'b');
+    std::string input(1000, ' ');
+
+    for( char& byte : input )
+    {
+        byte = static_cast<char>(letter(generator));
+    }
+
+    ASSERT_FALSE(find_all(matcher, input).empty());
+
+    for( const size_t threads : { 1, 2, 3, 7, 16 } )
+    {
+        ASSERT_EQ(matcher.find_all_parallel(input, threads), find_all(matcher, input)) << threads;
+
+        for( const size_t min_chunk : { 0, 1, 2, 3, 5, 64 } )
+        {
+            ASSERT_EQ(matcher.find_all_parallel(input, threads, min_chunk), find_all(matcher, input))
+                << threads << " " << min_chunk;
+        }
+    }
+
+    ASSERT_TRUE(matcher.find_all_parallel("", 4).empty());
+    ASSERT_EQ(matcher.find_all_parallel("aba", 8, 1), find_all(matcher, "aba"));
+    ASSERT_EQ(matcher.find_all_parallel("ababababa", 9, 1), find_all(matcher, "ababababa"));
+}
+
+TEST(ShiftAnd, FindAllParallelPeriodic)
+{
+    const ShiftAnd run({ 'a', 'a', 'a' });
+    const ShiftAnd digits({ DIGIT, DIGIT });
+    const std::string letters(1000, 'a');
+    const std::string numbers = std::string(333, '7') + "x" + std::string(500, '1');
+
+    for( const size_t threads : { 2, 3, 7, 16 } )
+    {
+        for( const size_t min_chunk : { 1, 10, 64 } )
+        {
+            ASSERT_EQ(run.find_all_parallel(letters, threads, min_chunk), find_all(run, letters));
+            ASSERT_EQ(digits.find_all_parallel(numbers, threads, min_chunk), find_all(digits, numbers));
+        }
+    }
+}
+
+TEST(ShiftAnd, FindLines)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT, '-', DIGIT, DIGIT });
+    const std::string input = "a 12-34\n12-\n34\n56-78\n\n90-12 34-56";
+
+    ASSERT_EQ(matcher.find_lines(input), (std::vector<Match> { { 0, 7 }, { 15, 20 }, { 22, 33 } }));
+    ASSERT_EQ(matcher.find_lines(input, true), (std::vector<Match> { { 15, 20 } }));
+    ASSERT_TRUE(matcher.find_lines("").empty());
+    ASSERT_TRUE(matcher.find_lines(std::string_view()).empty());
+    ASSERT_EQ(matcher.find_lines("12-34\n"), (std::vector<Match> { { 0, 5 } }));
+}
+
+TEST(ShiftAnd, Segments)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT, '-', DIGIT, DIGIT });
+    const std::vector<Match> expected { { 3, 8 }, { 9, 14 } };
+    const std::array<std::string_view, 5> split { "id 1", "", "2-", "34 5", "6-78" };
+    const std::string_view whole = "id 12-34 56-78";
+
+    ASSERT_EQ(matcher.find_all(split.data(), split.size()), expected);
+    ASSERT_EQ(matcher.find_all(&whole, 1), expected);
+    ASSERT_TRUE(matcher.find_all(nullptr, 0).empty());
+
+    ASSERT_EQ(matcher.find(split.data(), split.size()), expected[0]);
+    ASSERT_EQ(matcher.find(split.data(), split.size(), 4), expected[1]);
+    ASSERT_EQ(matcher.find(split.data(), split.size(), 10), std::nullopt);
+    ASSERT_EQ(matcher.find(split.data(), split.size(), 20), std::nullopt);
+
+    ASSERT_TRUE(is_match(matcher, split.data(), split.size()));
+    ASSERT_FALSE(is_match(matcher, split.data(), 3));
+    ASSERT_EQ(count_matches(matcher, split.data(), split.size()), 2);
+    ASSERT_EQ(count_matches(matcher, nullptr, 0), 0);
+}
+
+TEST(ShiftAnd, Iterators)
+{
+    const ShiftAnd matcher({ DIGIT, DIGIT, '-', DIGIT, DIGIT });
+    const std::string input = "id 12-34 56-78";
+    const std::deque<char> deque(input.begin(), input.end());
+    std::istringstream stream(input);
+
+    ASSERT_EQ(matcher.find(deque.begin(), deque.end()), (Match { 3, 8 }));
+    ASSERT_EQ(matcher.find(deque.begin(), deque.begin() + 7), std::nullopt);
+    ASSERT_EQ(matcher.find(deque.begin(), deque.end(), 4), (Match { 9, 14 }));
+    ASSERT_EQ(matcher.find(deque.begin(), deque.end(), 20), std::nullopt);
+    ASSERT_EQ
+    (
+        matcher.find_all(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()),
+        find_all(matcher, input)
+    );
+}
+
+TEST(ShiftAnd, ContiguousIterators)
+{
+    const ShiftAnd matcher({ '"', ByteClass({}, { '"' }), '"' });
+    std::string input = std::string(50, 'x') + "\"a\" \"b\"";
+    std::vector<char> vector(input.begin(), input.end());
+
+    static_assert(xregex::engine::is_contiguous_char_v<char*>);
+    static_assert(xregex::engine::is_contiguous_char_v<std::string::iterator>);
+    static_assert(!xregex::engine::is_contiguous_char_v<std::deque<char>::iterator>);
+
+    ASSERT_EQ(matcher.find(input.data(), input.data() + input.size()), (Match { 50, 53 }));
+    ASSERT_EQ(matcher.find(input.begin(), input.end(), 51), (Match { 52, 55 }));
+    ASSERT_EQ(matcher.find_all(vector.begin(), vector.end()), find_all(matcher, input));
+
+    ShiftAnd::State state = 0;
+    const auto stop = matcher.scan(state, input.begin(), input.end(), 0, [](const Match&) { return false; });
+
+    ASSERT_EQ(stop - input.begin(), 53);
+}
+
+TEST(ShiftAnd, StartByteSkip)
+{
+    const ShiftAnd::Pattern pattern { '"', ByteClass({}, { '"' }), '"' };
+    const ShiftAnd matcher(pattern);
+    const std::string input = std::string(100, 'x') + "\"\"\"a\" \"b";
+    const std::string_view segment = input;
+
+    ASSERT_EQ(matcher.find(input), (Match { 102, 105 }));
+    ASSERT_EQ(matcher.find(input, 101), (Match { 102, 105 }));
+    ASSERT_EQ(matcher.find(input, 103), (Match { 104, 107 }));
+    ASSERT_EQ(matcher.find(input, 105), std::nullopt);
+    ASSERT_TRUE(is_match(matcher, input));
+    ASSERT_FALSE(is_match(matcher, std::string(100, 'x')));
+    ASSERT_EQ(find_all(matcher, input), matcher.find_all(&segment, 1));
+    ASSERT_EQ(count_matches(matcher, input), 1);
+    ASSERT_EQ(matcher.find_overlapping(input), (std::vector<Match> { { 102, 105 }, { 104, 107 } }));
+}
+
+TEST(ShiftAnd, StartClassSkip)
+{
+    const ByteClass SELECT({ 'S', 's' });
+    const ByteClass QUOTE({ '"', '\'', '`' });
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> letter(0, 19);
+
+    for( const ShiftAnd::Pattern& pattern : { ShiftAnd::Pattern { SELECT, 'e' }, ShiftAnd::Pattern { QUOTE, 'x', QUOTE } } )
+    {
+        const ShiftAnd matcher(pattern);
+
+        for( size_t size = 0; size < 200; ++size )
+        {
+            std::string input(size, '.');
+
+            for( char& byte : input )
+            {
+                static const std::string_view rare = "Sse\"'`x";
+                const int pick = letter(generator);
+                byte = pick < static_cast<int>(rare.size()) ? rare[pick] : 'x';
+            }
+
+            const std::deque<char> deque(input.begin(), input.end());
+
+            ASSERT_EQ(find_all(matcher, input), matcher.find_all(deque.begin(), deque.end())) << input;
+            ASSERT_EQ(matcher.find_overlapping(input).size(), count_overlapping(matcher, deque)) << input;
+        }
+    }
+}
+
+TEST(ShiftAnd, OverlappingPrefix)
+{
+    const ShiftAnd matcher({ 'a', 'a', 'b' });
+
+    ASSERT_EQ(matcher.find("aaaab"), (Match { 2, 5 }));
+}
+
+TEST(ShiftAnd, LongestPattern)
+{
+    const ShiftAnd::Pattern pattern(ShiftAnd::MAX_LENGTH, ByteClass('x'));
+    const ShiftAnd matcher(pattern);
+    const std::string input = "y" + std::string(ShiftAnd::MAX_LENGTH, 'x');
+
+    ASSERT_EQ(matcher.find(input), (Match { 1, input.size() }));
+}
+
+TEST(ShiftAnd, Invalid)
+{
+    ASSERT_THROW(ShiftAnd(ShiftAnd::Pattern()), std::invalid_argument);
+    ASSERT_THROW(ShiftAnd(ShiftAnd::Pattern(ShiftAnd::MAX_LENGTH + 1, ByteClass('x'))), std::length_error);
+}
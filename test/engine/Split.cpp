@@ -0,0 +1,65 @@
+/**
+ * @file Split.cpp
+ * @brief Test file for input splitting
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include <xregex/engine/ShiftAnd.hpp>
+#include <xregex/engine/Split.hpp>
+
+using xregex::common::ByteClass;
+using xregex::engine::ShiftAnd;
+using xregex::engine::split;
+
+static const ByteClass WHITESPACE({ ' ', '\t', '\r', '\n' });
+
+TEST(Split, Class)
+{
+    std::array<std::string_view, 8> fields;
+
+    ASSERT_EQ(split("GET /index.html\tHTTP/1.1", WHITESPACE, fields.data(), fields.size()), 3);
+    ASSERT_EQ(fields[0], "GET");
+    ASSERT_EQ(fields[1], "/index.html");
+    ASSERT_EQ(fields[2], "HTTP/1.1");
+
+    ASSERT_EQ(split(" a  ", WHITESPACE, fields.data(), fields.size()), 4);
+    ASSERT_EQ(fields[0], "");
+    ASSERT_EQ(fields[1], "a");
+    ASSERT_EQ(fields[3], "");
+
+    ASSERT_EQ(split("", WHITESPACE, fields.data(), fields.size()), 1);
+    ASSERT_EQ(fields[0], "");
+}
+
+TEST(Split, ClassCapacity)
+{
+    std::array<std::string_view, 2> fields;
+
+    ASSERT_EQ(split("a b c", WHITESPACE, fields.data(), fields.size()), 2);
+    ASSERT_EQ(fields[0], "a");
+    ASSERT_EQ(fields[1], "b c");
+
+    ASSERT_EQ(split("a b c", WHITESPACE, fields.data(), 0), 0);
+}
+
+TEST(Split, Matcher)
+{
+    const ShiftAnd matcher({ ',', ' ' });
+    std::array<std::string_view, 8> fields;
+
+    ASSERT_EQ(split("a, b,c, d", matcher, fields.data(), fields.size()), 3);
+    ASSERT_EQ(fields[0], "a");
+    ASSERT_EQ(fields[1], "b,c");
+    ASSERT_EQ(fields[2], "d");
+
+    ASSERT_EQ(split("a, b, c", matcher, fields.data(), 2), 2);
+    ASSERT_EQ(fields[1], "b, c");
+}